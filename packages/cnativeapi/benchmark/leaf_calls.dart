@@ -0,0 +1,104 @@
+// Calls per second through the leaf bindings listed under `functions.leaf`
+// in ffigen.yaml, against the same native functions bound without
+// `isLeaf`.
+//
+// Build the example app once so the native library exists, then run:
+//
+//   dart run benchmark/leaf_calls.dart [path/to/libcnativeapi.so]
+//
+// Without a path the library is looked up by name, as `cnativeApiBindings`
+// does. On macOS the symbols are only in the app process, so pass the path
+// to the built dylib there.
+import 'dart:ffi' as ffi;
+import 'dart:io';
+
+import 'package:cnativeapi/cnativeapi.dart';
+import 'package:ffi/ffi.dart' as pkg_ffi;
+
+const Duration _runTime = Duration(seconds: 1);
+
+void main(List<String> arguments) {
+  final library = arguments.isEmpty
+      ? _openDefault()
+      : ffi.DynamicLibrary.open(arguments.first);
+  final bindings = CNativeApiBindings(library);
+
+  final colorToArgb = library
+      .lookupFunction<
+        ffi.UnsignedInt Function(native_color_t),
+        int Function(native_color_t)
+      >('native_color_to_argb');
+  final colorFromRgba = library
+      .lookupFunction<
+        native_color_t Function(
+          ffi.UnsignedChar,
+          ffi.UnsignedChar,
+          ffi.UnsignedChar,
+          ffi.UnsignedChar,
+        ),
+        native_color_t Function(int, int, int, int)
+      >('native_color_from_rgba');
+  final acceleratorIsEmpty = library
+      .lookupFunction<
+        ffi.Bool Function(native_keyboard_accelerator_t),
+        bool Function(native_keyboard_accelerator_t)
+      >('native_keyboard_accelerator_is_empty');
+
+  final color = bindings.native_color_from_rgba(12, 34, 56, 255);
+  // calloc zero-fills: no modifiers and a null key.
+  final acceleratorPointer = pkg_ffi.calloc<native_keyboard_accelerator_t>();
+  final accelerator = acceleratorPointer.ref;
+
+  _compare(
+    'native_color_to_argb',
+    () => bindings.native_color_to_argb(color),
+    () => colorToArgb(color),
+  );
+  _compare(
+    'native_color_from_rgba',
+    () => bindings.native_color_from_rgba(12, 34, 56, 255),
+    () => colorFromRgba(12, 34, 56, 255),
+  );
+  _compare(
+    'native_keyboard_accelerator_is_empty',
+    () => bindings.native_keyboard_accelerator_is_empty(accelerator),
+    () => acceleratorIsEmpty(accelerator),
+  );
+
+  pkg_ffi.calloc.free(acceleratorPointer);
+}
+
+ffi.DynamicLibrary _openDefault() {
+  if (Platform.isMacOS) return ffi.DynamicLibrary.process();
+  if (Platform.isLinux) return ffi.DynamicLibrary.open('libcnativeapi.so');
+  if (Platform.isWindows) return ffi.DynamicLibrary.open('cnativeapi.dll');
+  throw UnsupportedError('Unknown platform: ${Platform.operatingSystem}');
+}
+
+void _compare(String name, void Function() leaf, void Function() regular) {
+  final leafRate = _callsPerSecond(leaf);
+  final regularRate = _callsPerSecond(regular);
+  final speedup = leafRate / regularRate;
+  stdout.writeln(name);
+  stdout.writeln('  leaf:    ${_format(leafRate)} calls/s');
+  stdout.writeln('  regular: ${_format(regularRate)} calls/s');
+  stdout.writeln('  speedup: ${speedup.toStringAsFixed(2)}x');
+}
+
+double _callsPerSecond(void Function() call) {
+  // Warm up so both variants are measured optimized.
+  for (var i = 0; i < 100000; i++) {
+    call();
+  }
+  final stopwatch = Stopwatch()..start();
+  var calls = 0;
+  while (stopwatch.elapsed < _runTime) {
+    for (var i = 0; i < 10000; i++) {
+      call();
+    }
+    calls += 10000;
+  }
+  return calls / (stopwatch.elapsedMicroseconds / 1e6);
+}
+
+String _format(double rate) => '${(rate / 1e6).toStringAsFixed(1)}M';
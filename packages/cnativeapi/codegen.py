@@ -6,7 +6,8 @@ Script to regenerate bindings by:
 3. Updating ios/cnativeapi/Sources/cnativeapi/cnativeapi.mm include statements
 4. Updating macos/cnativeapi/Sources/cnativeapi/include/cnativeapi.h
 5. Updating ios/cnativeapi/Sources/cnativeapi/include/cnativeapi.h
-6. Updating ffigen.yaml with all C API header files
+6. Updating ffigen.yaml with all C API header files (and checking that
+   every function in its leaf list is still declared)
 7. Generating bindings with ffigen
 """
 
@@ -225,6 +226,45 @@ def update_ffigen_yaml(ffigen_path, capi_headers):
     return True
 
 
+def check_leaf_functions(ffigen_path, cxx_impl_dir):
+    """Warn about leaf functions in ffigen.yaml that no C API header declares.
+
+    The leaf list is maintained by hand, so a function renamed or removed
+    upstream would otherwise linger there silently.
+    """
+    with open(ffigen_path, "r", encoding="utf-8") as f:
+        content = f.read()
+
+    leaf_match = re.search(
+        r"^functions:\n(?:  #.*\n)*  leaf:\n    include:\n((?:      - .*\n)+)",
+        content,
+        re.MULTILINE,
+    )
+    if not leaf_match:
+        return True
+
+    leaf_functions = re.findall(r'      - "([^"]+)"', leaf_match.group(1))
+
+    declarations = ""
+    for header_file in (cxx_impl_dir / "src" / "capi").glob("*_c.h"):
+        with open(header_file, "r", encoding="utf-8") as f:
+            declarations += f.read()
+
+    stale = [
+        name
+        for name in leaf_functions
+        if not re.search(r"\b" + re.escape(name) + r"\s*\(", declarations)
+    ]
+    if stale:
+        print(f"Warning: {len(stale)} leaf function(s) not found in C API headers:")
+        for name in stale:
+            print(f"  - {name}")
+        return False
+
+    print(f"All {len(leaf_functions)} leaf functions are declared")
+    return True
+
+
 def find_source_files(cxx_impl_dir, platform):
     """Find all source files (.cpp and .mm) needed for the specified platform."""
     src_dir = cxx_impl_dir / "src"
@@ -489,6 +529,8 @@ def main():
         if not update_ffigen_yaml(ffigen_path, capi_headers):
             print("\nError: Failed to update ffigen configuration")
             return 1
+        if not check_leaf_functions(ffigen_path, cxx_impl_dir):
+            print("Update the `functions.leaf` list in ffigen.yaml")
 
     # Step 7: Generate bindings using ffigen
     print("\nStep 7/7: Generating Dart bindings")
@@ -175,7 +175,9 @@ class CNativeApiBindings {
       >('native_keyboard_accelerator_is_empty');
   late final _native_keyboard_accelerator_is_empty =
       _native_keyboard_accelerator_is_emptyPtr
-          .asFunction<bool Function(native_keyboard_accelerator_t)>();
+          .asFunction<bool Function(native_keyboard_accelerator_t)>(
+            isLeaf: true,
+          );
 
   /// Frees everything the struct owns.
   void native_keyboard_accelerator_free(
@@ -262,7 +264,7 @@ class CNativeApiBindings {
         >
       >('native_color_from_rgba');
   late final _native_color_from_rgba = _native_color_from_rgbaPtr
-      .asFunction<native_color_t Function(int, int, int, int)>();
+      .asFunction<native_color_t Function(int, int, int, int)>(isLeaf: true);
 
   native_color_t native_color_from_hex(ffi.Pointer<ffi.Char> hex) {
     return _native_color_from_hex(hex);
@@ -273,7 +275,7 @@ class CNativeApiBindings {
         ffi.NativeFunction<native_color_t Function(ffi.Pointer<ffi.Char>)>
       >('native_color_from_hex');
   late final _native_color_from_hex = _native_color_from_hexPtr
-      .asFunction<native_color_t Function(ffi.Pointer<ffi.Char>)>();
+      .asFunction<native_color_t Function(ffi.Pointer<ffi.Char>)>(isLeaf: true);
 
   int native_color_to_rgba(native_color_t color) {
     return _native_color_to_rgba(color);
@@ -284,7 +286,7 @@ class CNativeApiBindings {
         'native_color_to_rgba',
       );
   late final _native_color_to_rgba = _native_color_to_rgbaPtr
-      .asFunction<int Function(native_color_t)>();
+      .asFunction<int Function(native_color_t)>(isLeaf: true);
 
   int native_color_to_argb(native_color_t color) {
     return _native_color_to_argb(color);
@@ -295,7 +297,7 @@ class CNativeApiBindings {
         'native_color_to_argb',
       );
   late final _native_color_to_argb = _native_color_to_argbPtr
-      .asFunction<int Function(native_color_t)>();
+      .asFunction<int Function(native_color_t)>(isLeaf: true);
 
   /// Creates a Window instance; release it with native_window_free().
   int native_window_create() {
@@ -5,5 +5,16 @@ library;
 export 'src/generated.dart';
 
 // Hand-written additions that sit on top of the generated bindings.
+export 'src/extensions/bulk_storage.dart';
+export 'src/extensions/deferred_setters.dart';
+export 'src/extensions/event_hub.dart';
+export 'src/extensions/image_cache.dart';
+export 'src/extensions/image_set.dart';
+export 'src/extensions/menu_spec.dart';
+export 'src/extensions/preferences_notifier.dart';
+export 'src/extensions/typed_preferences.dart';
+export 'src/extensions/window_event_coalescer.dart';
+export 'src/extensions/window_state.dart';
+export 'src/extensions/window_update.dart';
 export 'src/widgets/context_menu_region.dart';
 export 'src/widgets/image_asset.dart';
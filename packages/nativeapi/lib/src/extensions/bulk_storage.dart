@@ -0,0 +1,160 @@
+import 'dart:convert';
+import 'dart:ffi' as ffi;
+
+import 'package:cnativeapi/cnativeapi.dart' as c;
+import 'package:ffi/ffi.dart' as pkg_ffi;
+
+import '../preferences.dart';
+import '../secure_storage.dart';
+
+final _bindings = c.cnativeApiBindings;
+
+/// Reading and writing many [Preferences] entries at once.
+///
+/// Hand-written rather than generated: the C API has no batch entry points,
+/// so each entry is still its own native call and a batch is not atomic.
+/// What a batch saves is the per-call string traffic. All the keys and
+/// values go into a single native allocation instead of two per call, and
+/// [getMany] reads the whole store in one call once enough keys are
+/// requested.
+extension PreferencesBatch on Preferences {
+  /// Writes every entry; returns how many the native side accepted.
+  int setMany(Map<String, String> entries) => _setMany(
+    entries,
+    (key, value) => _bindings.native_preferences_set(nativeHandle, key, value),
+  );
+
+  /// The stored values for those of [keys] that are present.
+  Map<String, String> getMany(Iterable<String> keys) => _getMany(
+    keys.toSet(),
+    size,
+    () => all,
+    (key, missing) =>
+        _bindings.native_preferences_get(nativeHandle, key, missing),
+  );
+
+  /// Removes every key; returns how many were actually removed.
+  int removeMany(Iterable<String> keys) => _removeMany(
+    keys,
+    (key) => _bindings.native_preferences_remove(nativeHandle, key),
+  );
+}
+
+/// Reading and writing many [SecureStorage] entries at once.
+///
+/// Same trade-offs as [PreferencesBatch]. The all-at-once read matters more
+/// here, because on Linux each call may be a round trip to the secret
+/// service.
+extension SecureStorageBatch on SecureStorage {
+  /// Writes every entry; returns how many the native side accepted.
+  int setMany(Map<String, String> entries) => _setMany(
+    entries,
+    (key, value) =>
+        _bindings.native_secure_storage_set(nativeHandle, key, value),
+  );
+
+  /// The stored values for those of [keys] that are present.
+  Map<String, String> getMany(Iterable<String> keys) => _getMany(
+    keys.toSet(),
+    size,
+    () => all,
+    (key, missing) =>
+        _bindings.native_secure_storage_get(nativeHandle, key, missing),
+  );
+
+  /// Removes every key; returns how many were actually removed.
+  int removeMany(Iterable<String> keys) => _removeMany(
+    keys,
+    (key) => _bindings.native_secure_storage_remove(nativeHandle, key),
+  );
+}
+
+typedef _NativeString = ffi.Pointer<ffi.Char>;
+
+/// The default [_getMany] passes per key, so that one `get` call both
+/// reads a value and reports it missing. U+FFFF is a noncharacter, which
+/// keeps this from colliding with anything a caller stores.
+const String _missing = '\uFFFFnativeapi.missing\uFFFF';
+
+int _setMany(
+  Map<String, String> entries,
+  bool Function(_NativeString key, _NativeString value) set,
+) {
+  final block = _StringBlock([...entries.keys, ...entries.values]);
+  var written = 0;
+  for (var i = 0; i < entries.length; i++) {
+    if (set(block[i], block[entries.length + i])) written++;
+  }
+  block.free();
+  return written;
+}
+
+Map<String, String> _getMany(
+  Set<String> keys,
+  int size,
+  Map<String, String> Function() all,
+  _NativeString Function(_NativeString key, _NativeString missing) get,
+) {
+  // Past a quarter of the store, one full read beats a call per key.
+  if (keys.length * 4 >= size) {
+    final entries = all();
+    return {
+      for (final key in keys)
+        if (entries.containsKey(key)) key: entries[key]!,
+    };
+  }
+
+  final block = _StringBlock([_missing, ...keys]);
+  final values = <String, String>{};
+  var i = 1;
+  for (final key in keys) {
+    final resultPointer = get(block[i++], block[0]);
+    if (resultPointer == ffi.nullptr) continue;
+    final value = resultPointer.cast<pkg_ffi.Utf8>().toDartString();
+    _bindings.free_c_str(resultPointer);
+    if (value != _missing) values[key] = value;
+  }
+  block.free();
+  return values;
+}
+
+int _removeMany(
+  Iterable<String> keys,
+  bool Function(_NativeString key) remove,
+) {
+  final block = _StringBlock(keys.toList());
+  var removed = 0;
+  for (var i = 0; i < block.length; i++) {
+    if (remove(block[i])) removed++;
+  }
+  block.free();
+  return removed;
+}
+
+/// Strings packed NUL-terminated into a single native allocation.
+final class _StringBlock {
+  _StringBlock(List<String> strings) {
+    final encoded = [for (final string in strings) utf8.encode(string)];
+    var total = 0;
+    for (final bytes in encoded) {
+      _offsets.add(total);
+      total += bytes.length + 1;
+    }
+    // calloc zero-fills, which supplies every terminator.
+    _memory = pkg_ffi.calloc<ffi.Uint8>(total == 0 ? 1 : total);
+    final bytes = _memory.asTypedList(total);
+    for (var i = 0; i < encoded.length; i++) {
+      bytes.setAll(_offsets[i], encoded[i]);
+    }
+  }
+
+  final List<int> _offsets = [];
+  late final ffi.Pointer<ffi.Uint8> _memory;
+
+  int get length => _offsets.length;
+
+  _NativeString operator [](int index) =>
+      (_memory + _offsets[index]).cast<ffi.Char>();
+
+  void free() => pkg_ffi.calloc.free(_memory);
+}
@@ -0,0 +1,149 @@
+import 'dart:async';
+import 'dart:ui';
+
+import 'package:meta/meta.dart';
+
+import '../image.dart';
+import '../menu.dart';
+import '../tray_icon.dart';
+import '../window.dart';
+
+/// Property writes held back until the next turn of the event loop.
+///
+/// Writes are keyed by object and property, so a burst of writes to one
+/// property collapses into a single native call carrying the last value.
+/// Everything pending goes out together from one timer, in the order of
+/// each property's last write.
+final class DeferredWrites {
+  DeferredWrites._();
+
+  /// The queue every `deferred` accessor writes into.
+  static final DeferredWrites instance = DeferredWrites._();
+
+  final Map<(Type, int, String), void Function()> _pending = {};
+  Timer? _timer;
+
+  /// How many property writes are waiting to be applied.
+  int get length => _pending.length;
+
+  /// Applies every pending write now instead of on the next turn.
+  ///
+  /// Call this before writing a property directly if a deferred write to
+  /// the same property may still be pending, or the older deferred value
+  /// will land on top of it.
+  void flush() {
+    _timer?.cancel();
+    _timer = null;
+    final writes = _pending.values.toList();
+    _pending.clear();
+    for (final write in writes) {
+      write();
+    }
+  }
+
+  /// Queues [write] as the pending write to [property] of the object
+  /// [type] and [id] identify, replacing any pending one.
+  @visibleForTesting
+  void queue(Type type, int id, String property, void Function() write) {
+    final key = (type, id, property);
+    _pending.remove(key);
+    _pending[key] = write;
+    _timer ??= Timer(Duration.zero, flush);
+  }
+}
+
+/// Deferred property writes on one [Window]; see [DeferredWrites].
+class DeferredWindow {
+  const DeferredWindow._(this.window);
+
+  /// The window the writes apply to.
+  final Window window;
+
+  set title(String value) => _queue('title', () => window.title = value);
+
+  set opacity(double value) => _queue('opacity', () => window.opacity = value);
+
+  set backgroundColor(Color value) =>
+      _queue('backgroundColor', () => window.backgroundColor = value);
+
+  set bounds(Rect value) => _queue('bounds', () => window.bounds = value);
+
+  set position(Offset value) =>
+      _queue('position', () => window.position = value);
+
+  void _queue(String property, void Function() write) =>
+      DeferredWrites.instance.queue(Window, window.id, property, write);
+}
+
+/// Deferred property writes on one [TrayIcon]; see [DeferredWrites].
+class DeferredTrayIcon {
+  const DeferredTrayIcon._(this.trayIcon);
+
+  /// The tray icon the writes apply to.
+  final TrayIcon trayIcon;
+
+  set title(String? value) => _queue('title', () => trayIcon.setTitle(value));
+
+  set tooltip(String? value) =>
+      _queue('tooltip', () => trayIcon.setTooltip(value));
+
+  set icon(Image? value) => _queue('icon', () => trayIcon.icon = value);
+
+  void _queue(String property, void Function() write) {
+    final id = trayIcon.getId();
+    DeferredWrites.instance.queue(TrayIcon, id, property, write);
+  }
+}
+
+/// Deferred property writes on one [MenuItem]; see [DeferredWrites].
+class DeferredMenuItem {
+  const DeferredMenuItem._(this.item);
+
+  /// The menu item the writes apply to.
+  final MenuItem item;
+
+  set label(String? value) => _queue('label', () => item.label = value);
+
+  set tooltip(String? value) => _queue('tooltip', () => item.tooltip = value);
+
+  set icon(Image? value) => _queue('icon', () => item.icon = value);
+
+  set isEnabled(bool value) =>
+      _queue('isEnabled', () => item.isEnabled = value);
+
+  set state(MenuItemState value) => _queue('state', () => item.state = value);
+
+  void _queue(String property, void Function() write) =>
+      DeferredWrites.instance.queue(MenuItem, item.id, property, write);
+}
+
+/// Fire-and-forget writes on a [Window].
+///
+/// Hand-written rather than generated: the C API has no asynchronous
+/// setters, so the queue lives on the Dart side. The native call still runs
+/// on this isolate's thread; what is saved is every redundant write in a
+/// burst.
+extension DeferredWindowSetters on Window {
+  /// Writes through here are applied on the next turn of the event loop.
+  ///
+  /// ```dart
+  /// window.deferred.opacity = animation.value;
+  /// ```
+  DeferredWindow get deferred => DeferredWindow._(this);
+}
+
+/// Fire-and-forget writes on a [TrayIcon], for progress-style updates.
+extension DeferredTrayIconSetters on TrayIcon {
+  /// Writes through here are applied on the next turn of the event loop.
+  ///
+  /// ```dart
+  /// trayIcon.deferred.tooltip = 'Syncing… $percent%';
+  /// ```
+  DeferredTrayIcon get deferred => DeferredTrayIcon._(this);
+}
+
+/// Fire-and-forget writes on a [MenuItem].
+extension DeferredMenuItemSetters on MenuItem {
+  /// Writes through here are applied on the next turn of the event loop.
+  DeferredMenuItem get deferred => DeferredMenuItem._(this);
+}
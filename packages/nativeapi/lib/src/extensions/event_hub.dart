@@ -0,0 +1,201 @@
+import '../application.dart';
+import '../display.dart';
+import '../display_manager.dart';
+import '../foundation/keyboard.dart';
+import '../keyboard_monitor.dart';
+import '../menu.dart';
+import '../shortcut.dart';
+import '../shortcut_manager.dart';
+import '../support.dart';
+import '../tray_icon.dart';
+import '../window.dart';
+import '../window_manager.dart';
+
+/// Fans one native listener out to any number of Dart listeners, each
+/// interested in particular event types.
+///
+/// Hand-written rather than generated: every `addListener` registers its
+/// own native listener, so with dozens of feature modules listening to the
+/// same emitter each event crosses into Dart, and is decoded, once per
+/// listener, mostly for listeners that then ignore it. A hub holds a
+/// single native registration while it has listeners at all, decodes each
+/// event once, and only calls the listeners whose type matches.
+///
+/// The ids [on] returns belong to the hub and are only meaningful to
+/// [off] on the same hub.
+class EventHub<E extends Object> {
+  /// A hub over one emitter's `addListener` and `removeListener`.
+  ///
+  /// [onListen] runs when the first listener is added and [onCancel] when
+  /// the last one is removed, as with a `StreamController`.
+  EventHub(
+    this._addListener,
+    this._removeListener, {
+    void Function()? onListen,
+    void Function()? onCancel,
+  }) : _onListen = onListen,
+       _onCancel = onCancel;
+
+  final ListenerId Function(void Function(E)) _addListener;
+  final bool Function(ListenerId) _removeListener;
+  final void Function()? _onListen;
+  final void Function()? _onCancel;
+
+  final Map<ListenerId, _Subscription<E>> _subscriptions = {};
+  ListenerId _nextId = 1;
+  ListenerId? _nativeListenerId;
+
+  /// Registers [callback] for events of type [T] only.
+  ///
+  /// ```dart
+  /// final id = WindowManager.instance.events.on<WindowFocusedEvent>(
+  ///   (event) => highlight(event.windowId),
+  /// );
+  /// ```
+  ListenerId on<T extends E>(void Function(T) callback) {
+    final id = _nextId++;
+    _subscriptions[id] = _Subscription<E>(
+      (event) => event is T,
+      (event) => callback(event as T),
+    );
+    if (_nativeListenerId == null) {
+      _nativeListenerId = _addListener(_dispatch);
+      _onListen?.call();
+    }
+    return id;
+  }
+
+  /// Unregisters a listener added with [on]. Returns false if unknown.
+  ///
+  /// The native listener goes away with the last Dart one.
+  bool off(ListenerId id) {
+    if (_subscriptions.remove(id) == null) return false;
+    final nativeListenerId = _nativeListenerId;
+    if (_subscriptions.isEmpty && nativeListenerId != null) {
+      _removeListener(nativeListenerId);
+      _nativeListenerId = null;
+      _onCancel?.call();
+    }
+    return true;
+  }
+
+  /// Whether any listener is registered.
+  bool get hasListeners => _subscriptions.isNotEmpty;
+
+  void _dispatch(E event) {
+    // A callback may add or remove listeners; iterate over a snapshot.
+    for (final subscription in _subscriptions.values.toList()) {
+      if (subscription.accepts(event)) subscription.callback(event);
+    }
+  }
+}
+
+class _Subscription<E> {
+  _Subscription(this.accepts, this.callback);
+
+  final bool Function(E) accepts;
+  final void Function(E) callback;
+}
+
+final _windowEvents = EventHub<WindowEvent>(
+  WindowManager.instance.addListener,
+  WindowManager.instance.removeListener,
+);
+
+final _displayEvents = EventHub<DisplayEvent>(
+  DisplayManager.instance.addListener,
+  DisplayManager.instance.removeListener,
+);
+
+final _shortcutEvents = EventHub<ShortcutEvent>(
+  ShortcutManager.instance.addListener,
+  ShortcutManager.instance.removeListener,
+);
+
+final _applicationEvents = EventHub<ApplicationEvent>(
+  Application.instance.addListener,
+  Application.instance.removeListener,
+);
+
+/// The shared [EventHub] for window events.
+extension WindowManagerEvents on WindowManager {
+  EventHub<WindowEvent> get events => _windowEvents;
+}
+
+/// The shared [EventHub] for display events.
+extension DisplayManagerEvents on DisplayManager {
+  EventHub<DisplayEvent> get events => _displayEvents;
+}
+
+/// The shared [EventHub] for shortcut events.
+extension ShortcutManagerEvents on ShortcutManager {
+  EventHub<ShortcutEvent> get events => _shortcutEvents;
+}
+
+/// The shared [EventHub] for application events.
+extension ApplicationEvents on Application {
+  EventHub<ApplicationEvent> get events => _applicationEvents;
+}
+
+final Map<MenuId, EventHub<MenuEvent>> _menuEvents = {};
+
+final Map<MenuItemId, EventHub<MenuEvent>> _menuItemEvents = {};
+
+final Map<TrayIconId, EventHub<TrayIconEvent>> _trayIconEvents = {};
+
+final _keyboardEvents = Expando<EventHub<KeyboardEvent>>();
+
+/// The hub for the emitter [id] in [hubs], which only holds hubs that have
+/// listeners. Wrappers are handed out afresh for the same native object, so
+/// hubs go by id; and a hub without listeners is not kept, so it does not
+/// keep the wrapper it was made from alive either.
+EventHub<E> _hubFor<K, E extends Object>(
+  Map<K, EventHub<E>> hubs,
+  K id,
+  ListenerId Function(void Function(E)) addListener,
+  bool Function(ListenerId) removeListener,
+) {
+  final existing = hubs[id];
+  if (existing != null) return existing;
+  late final EventHub<E> hub;
+  hub = EventHub<E>(
+    addListener,
+    removeListener,
+    onListen: () => hubs.putIfAbsent(id, () => hub),
+    onCancel: () {
+      if (identical(hubs[id], hub)) hubs.remove(id);
+    },
+  );
+  return hub;
+}
+
+/// An [EventHub] for one menu's events.
+///
+/// Every wrapper of the same native menu gets the same hub while it has
+/// listeners, so `trayIcon.getContextMenu()!.events` can be called again
+/// to [EventHub.off] what an earlier call registered.
+extension MenuEvents on Menu {
+  EventHub<MenuEvent> get events =>
+      _hubFor(_menuEvents, id, addListener, removeListener);
+}
+
+/// An [EventHub] for one menu item's events; see [MenuEvents].
+extension MenuItemEvents on MenuItem {
+  EventHub<MenuEvent> get events =>
+      _hubFor(_menuItemEvents, id, addListener, removeListener);
+}
+
+/// An [EventHub] for one tray icon's events; see [MenuEvents].
+extension TrayIconEvents on TrayIcon {
+  EventHub<TrayIconEvent> get events =>
+      _hubFor(_trayIconEvents, getId(), addListener, removeListener);
+}
+
+/// An [EventHub] for one keyboard monitor's events.
+///
+/// Keyboard monitors are only ever created by the app, never handed out
+/// again by the C API, so the hub simply belongs to this object.
+extension KeyboardMonitorEvents on KeyboardMonitor {
+  EventHub<KeyboardEvent> get events =>
+      _keyboardEvents[this] ??= EventHub(addListener, removeListener);
+}
@@ -0,0 +1,193 @@
+import 'dart:collection';
+import 'dart:io';
+
+import '../image.dart';
+
+/// Counters describing what a [NativeImageCache] has done so far.
+class NativeImageCacheStats {
+  const NativeImageCacheStats({
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+    required this.entries,
+    required this.bytes,
+  });
+
+  final int hits;
+  final int misses;
+  final int evictions;
+  final int entries;
+
+  /// Estimated decoded size of everything cached, at four bytes per pixel.
+  final int bytes;
+}
+
+/// A size-bounded, least-recently-used cache of decoded [Image]s.
+///
+/// Hand-written rather than generated: `native_image_from_file` decodes on
+/// every call, and menus that rebuild with the same dozen icons pay for
+/// that each time they open. Files are keyed by their canonical path plus
+/// modification time and length, so an icon rewritten on disk is decoded
+/// again; base64 input is keyed by a hash of its content, so the strings
+/// themselves are not kept alive.
+///
+/// A path is only tied to a key once its decode has succeeded, so a file
+/// that fails to decode leaves nothing behind.
+///
+/// Every caller asking for the same file gets the same [Image]. Do not
+/// [Image.dispose] one obtained here: the handle is released once the cache
+/// has evicted it and no caller references it any more.
+class NativeImageCache {
+  NativeImageCache({int maximumBytes = 32 * 1024 * 1024})
+    : _maximumBytes = maximumBytes;
+
+  /// The cache [ImageAsset.cachedFromAsset] and [ImageSet] load through.
+  static final NativeImageCache instance = NativeImageCache();
+
+  // Iteration order is recency order: the first entry is evicted first.
+  final LinkedHashMap<Object, _CacheEntry> _entries = LinkedHashMap();
+  final Map<String, Object> _keysByPath = {};
+
+  int _maximumBytes;
+  int _bytes = 0;
+  int _hits = 0;
+  int _misses = 0;
+  int _evictions = 0;
+
+  /// Upper bound on the estimated decoded size of all cached images.
+  int get maximumBytes => _maximumBytes;
+
+  set maximumBytes(int value) {
+    _maximumBytes = value;
+    _trim();
+  }
+
+  NativeImageCacheStats get stats => NativeImageCacheStats(
+    hits: _hits,
+    misses: _misses,
+    evictions: _evictions,
+    entries: _entries.length,
+    bytes: _bytes,
+  );
+
+  /// Like [Image.fromFile], decoding only when the file is not cached.
+  Image? fromFile(String filePath) {
+    final stat = FileStat.statSync(filePath);
+    if (stat.type == FileSystemEntityType.notFound) {
+      return Image.fromFile(filePath);
+    }
+    final source = _FileSource(File(filePath).resolveSymbolicLinksSync(), stat);
+    return _lookup(
+      source.key,
+      () => Image.fromFile(source.path),
+      path: source.path,
+    );
+  }
+
+  /// Like [fromFile], but the file is looked up on disk asynchronously,
+  /// so a hit does no blocking I/O on the calling thread.
+  ///
+  /// A miss still decodes on the calling thread. The C API does not say
+  /// that `native_image_from_file` may run on any other.
+  Future<Image?> fromFileAsync(String filePath) async {
+    final stat = await FileStat.stat(filePath);
+    if (stat.type == FileSystemEntityType.notFound) {
+      return Image.fromFile(filePath);
+    }
+    final source = _FileSource(
+      await File(filePath).resolveSymbolicLinks(),
+      stat,
+    );
+    return _lookup(
+      source.key,
+      () => Image.fromFile(source.path),
+      path: source.path,
+    );
+  }
+
+  /// Like [Image.fromBase64], decoding only when the data is not cached.
+  Image? fromBase64(String base64Data) =>
+      _lookup(_contentKey(base64Data), () => Image.fromBase64(base64Data));
+
+  /// Drops every cached image. Counters are kept.
+  void purge() {
+    _entries.clear();
+    _keysByPath.clear();
+    _bytes = 0;
+  }
+
+  /// 64-bit FNV-1a over [data], paired with its length.
+  static (int, int) _contentKey(String data) {
+    var hash = 0xcbf29ce484222325;
+    for (final unit in data.codeUnits) {
+      hash = (hash ^ unit) * 0x100000001b3;
+    }
+    return (data.length, hash);
+  }
+
+  Image? _lookup(Object key, Image? Function() decode, {String? path}) {
+    final hit = _touch(key);
+    if (hit != null) return hit;
+
+    _misses++;
+    final image = decode();
+    if (image != null) _insert(key, image, path: path);
+    return image;
+  }
+
+  /// Returns the cached image for [key] and marks it most recently used.
+  Image? _touch(Object key) {
+    final entry = _entries.remove(key);
+    if (entry == null) return null;
+    _hits++;
+    _entries[key] = entry;
+    return entry.image;
+  }
+
+  /// Caches [image] under [key]; [path] is the file it was decoded from.
+  void _insert(Object key, Image image, {String? path}) {
+    if (path != null) {
+      // A file rewritten on disk gets a new key; drop the stale decode.
+      final previousKey = _keysByPath[path];
+      if (previousKey != null && previousKey != key) _remove(previousKey);
+      _keysByPath[path] = key;
+    }
+    _remove(key);
+    final size = image.size;
+    final entry = _CacheEntry(image, (size.width * size.height * 4).round());
+    _entries[key] = entry;
+    _bytes += entry.bytes;
+    _trim();
+  }
+
+  void _remove(Object key) {
+    final entry = _entries.remove(key);
+    if (entry != null) _bytes -= entry.bytes;
+  }
+
+  void _trim() {
+    while (_bytes > _maximumBytes && _entries.isNotEmpty) {
+      final key = _entries.keys.first;
+      _remove(key);
+      _keysByPath.removeWhere((_, value) => value == key);
+      _evictions++;
+    }
+  }
+}
+
+/// A file on disk, identified by its canonical path and what [FileStat]
+/// said about it.
+class _FileSource {
+  _FileSource(this.path, FileStat stat)
+    : key = (path, stat.modified.microsecondsSinceEpoch, stat.size);
+
+  final String path;
+  final Object key;
+}
+
+class _CacheEntry {
+  _CacheEntry(this.image, this.bytes);
+
+  final Image image;
+  final int bytes;
+}
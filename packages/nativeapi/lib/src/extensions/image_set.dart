@@ -0,0 +1,80 @@
+import 'dart:io';
+
+import 'package:path/path.dart' as path;
+
+import '../display.dart';
+import '../image.dart';
+import '../widgets/image_asset.dart';
+import 'image_cache.dart';
+
+/// One icon drawn at several pixel densities, picked per display.
+///
+/// Hand-written rather than generated: the C++ `Image` holds a single
+/// bitmap and scales it at draw time. Handing it a representation that
+/// already matches the display avoids both the per-draw resampling and the
+/// blur of upscaling a 1x bitmap on a HiDPI screen.
+///
+/// Representations are decoded on first use, through
+/// [NativeImageCache.instance], so a set that is only ever shown on 2x
+/// displays never loads its 1x file. The set itself holds no images: the
+/// cache alone decides how long a representation stays decoded, so its
+/// size limit covers every set too. Hold on to the [Image] [resolve]
+/// returns for as long as it is shown.
+class ImageSet {
+  /// A set built from file paths keyed by the scale they were drawn for.
+  ImageSet(Map<double, String> paths)
+    : assert(paths.isNotEmpty, 'An ImageSet needs at least one image'),
+      _paths = Map.unmodifiable(paths),
+      _scales = paths.keys.toList()..sort();
+
+  /// A set built from a bundled asset and its resolution-aware variants.
+  ///
+  /// Follows Flutter's own asset layout, so the files the app already
+  /// ships for `Image.asset` are picked up as is:
+  ///
+  /// ```yaml
+  /// flutter:
+  ///   assets:
+  ///     - assets/icons/tray.png      # 1x
+  ///     - assets/icons/2.0x/tray.png
+  ///     - assets/icons/3.0x/tray.png
+  /// ```
+  factory ImageSet.fromAsset(String name) {
+    final paths = <double, String>{1.0: ImageAsset.assetPath(name)};
+    for (final scale in _variantScales) {
+      final variant = ImageAsset.assetPath(
+        path.join(
+          path.dirname(name),
+          '${scale.toStringAsFixed(1)}x',
+          path.basename(name),
+        ),
+      );
+      if (File(variant).existsSync()) paths[scale] = variant;
+    }
+    return ImageSet(paths);
+  }
+
+  /// The variant folders [ImageSet.fromAsset] looks for next to the 1x file.
+  static const List<double> _variantScales = [1.5, 2.0, 3.0, 4.0];
+
+  final Map<double, String> _paths;
+  final List<double> _scales;
+
+  /// The scales this set has a representation for, in ascending order.
+  List<double> get scales => List.unmodifiable(_scales);
+
+  /// The representation to draw at [scale].
+  ///
+  /// That is the smallest one drawn for at least [scale], so it only ever
+  /// gets scaled down; when none is large enough, the largest one.
+  Image? resolve(double scale) {
+    final match = _scales.firstWhere(
+      (candidate) => candidate >= scale,
+      orElse: () => _scales.last,
+    );
+    return NativeImageCache.instance.fromFile(_paths[match]!);
+  }
+
+  /// The representation to draw on [display].
+  Image? forDisplay(Display display) => resolve(display.scaleFactor);
+}
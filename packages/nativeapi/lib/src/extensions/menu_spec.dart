@@ -0,0 +1,292 @@
+import '../foundation/keyboard.dart';
+import '../image.dart';
+import '../menu.dart';
+
+/// A description of one menu item, for [MenuSpecs.apply].
+class MenuItemSpec {
+  const MenuItemSpec({
+    this.key,
+    required this.label,
+    this.type = MenuItemType.normal,
+    this.tooltip,
+    this.icon,
+    this.accelerator,
+    this.isEnabled = true,
+    this.state = MenuItemState.unchecked,
+    this.radioGroup,
+    this.submenu,
+  });
+
+  const MenuItemSpec.separator({this.key})
+    : label = '',
+      type = MenuItemType.separator,
+      tooltip = null,
+      icon = null,
+      accelerator = null,
+      isEnabled = true,
+      state = MenuItemState.unchecked,
+      radioGroup = null,
+      submenu = null;
+
+  /// What identifies this item across applies. Defaults to its type and
+  /// label, which is enough unless two siblings share a label or a label
+  /// changes while the item should stay the same.
+  final Object? key;
+  final String label;
+  final MenuItemType type;
+  final String? tooltip;
+  final Image? icon;
+  final KeyboardAccelerator? accelerator;
+  final bool isEnabled;
+  final MenuItemState state;
+  final int? radioGroup;
+
+  /// The items of this item's submenu, if it has one.
+  final List<MenuItemSpec>? submenu;
+
+  Object get _identity => (type, key ?? label);
+
+  /// This spec without its icon and submenu, which is all [MenuSpecs]
+  /// needs to remember; it must not keep images or whole trees alive.
+  MenuItemSpec get _remembered => MenuItemSpec(
+    key: key,
+    label: label,
+    type: type,
+    tooltip: tooltip,
+    accelerator: accelerator,
+    isEnabled: isEnabled,
+    state: state,
+    radioGroup: radioGroup,
+  );
+}
+
+/// Bringing a [Menu] in line with a list of [MenuItemSpec]s.
+///
+/// Hand-written rather than generated: rebuilding a dynamic menu with
+/// `clear` and a fresh item per entry mutates the live platform menu once
+/// per step, and on Linux every one of those steps is re-exported over
+/// DBus. [apply] remembers what it built last time and only issues the
+/// inserts, removals and property writes that actually differ.
+///
+/// That memory is keyed by [Menu.id], not by the wrapper, because
+/// `TrayIcon.getContextMenu` and `MenuItem.submenu` hand out a new wrapper
+/// on every call. The C API does not report when a menu is freed, so what
+/// is remembered holds no handles or images, only item ids and plain
+/// values. Submenus [apply] detaches or drops are forgotten with them.
+///
+/// A menu's entry is otherwise kept until [forgetApplied] drops it. Call
+/// that before freeing a menu that [apply] has built, such as the context
+/// menu of a document window that is closing.
+extension MenuSpecs on Menu {
+  /// Makes this menu show exactly [items], in order.
+  ///
+  /// ```dart
+  /// trayMenu.apply([
+  ///   for (final file in recentFiles)
+  ///     MenuItemSpec(key: file.path, label: file.name),
+  ///   const MenuItemSpec.separator(),
+  ///   MenuItemSpec(key: 'connection', label: connectionLabel),
+  /// ]);
+  /// ```
+  ///
+  /// The first call takes the menu over and clears anything added to it
+  /// by other means. Items are matched to the previous call's by
+  /// [MenuItemSpec.key], so later calls keep the same [MenuItem]s, and
+  /// their ids, for entries that are still there.
+  void apply(List<MenuItemSpec> items) {
+    final menuId = id;
+    var applied = _applied[menuId];
+    // Also start over if something else has added or removed items since.
+    if (applied == null || applied.length != itemCount) {
+      if (applied != null) _forget(applied);
+      if (itemCount > 0) clear();
+      applied = _applied[menuId] = <_AppliedItem>[];
+    }
+
+    // Drop what is no longer wanted first, so indices below line up.
+    final wanted = <Object, int>{};
+    for (final spec in items) {
+      wanted.update(spec._identity, (count) => count + 1, ifAbsent: () => 1);
+    }
+    final kept = <Object, int>{};
+    final dropped = <_AppliedItem>[];
+    applied.removeWhere((item) {
+      final identity = item.spec._identity;
+      final count = kept.update(
+        identity,
+        (count) => count + 1,
+        ifAbsent: () => 1,
+      );
+      if (count <= (wanted[identity] ?? 0)) return false;
+      removeItemById(item.itemId);
+      dropped.add(item);
+      return true;
+    });
+    _forget(dropped);
+
+    for (var index = 0; index < items.length; index++) {
+      final spec = items[index];
+      final current = index < applied.length ? applied[index] : null;
+      if (current != null && current.spec._identity == spec._identity) {
+        current.update(this, spec);
+        continue;
+      }
+
+      final laterIndex = applied.indexWhere(
+        (item) => item.spec._identity == spec._identity,
+        index,
+      );
+      if (laterIndex >= 0) {
+        // Still wanted, just somewhere else.
+        final moved = applied.removeAt(laterIndex);
+        final item = getItemById(moved.itemId);
+        if (item != null) {
+          removeItem(item);
+          insertItem(index, item);
+        }
+        applied.insert(index, moved);
+        moved.update(this, spec);
+        continue;
+      }
+
+      final created = _AppliedItem.create(spec);
+      if (created == null) continue;
+      insertItem(index, created.$2);
+      applied.insert(index, created.$1);
+    }
+  }
+
+  /// The item [apply] built for the spec with this [MenuItemSpec.key].
+  MenuItem? appliedItem(Object key) {
+    for (final item in _applied[id] ?? const <_AppliedItem>[]) {
+      if (item.spec.key == key) return getItemById(item.itemId);
+    }
+    return null;
+  }
+
+  /// Forgets what [apply] built here, and in its submenus.
+  ///
+  /// The items stay in the menu; the next [apply] clears it and starts over.
+  void forgetApplied() {
+    final applied = _applied.remove(id);
+    if (applied != null) _forget(applied);
+  }
+
+  static final Map<MenuId, List<_AppliedItem>> _applied = {};
+
+  /// Forgets the submenus of [items], which are leaving their menu.
+  static void _forget(List<_AppliedItem> items) {
+    for (final item in items) {
+      final submenuId = item.submenuId;
+      if (submenuId == null) continue;
+      final nested = _applied.remove(submenuId);
+      if (nested != null) _forget(nested);
+    }
+  }
+}
+
+/// One item [MenuSpecs.apply] created, and the spec it last reflected.
+class _AppliedItem {
+  _AppliedItem(this.itemId, this.spec);
+
+  /// Creates the item for [spec]; also returns the new [MenuItem] so the
+  /// caller can insert it.
+  static (_AppliedItem, MenuItem)? create(MenuItemSpec spec) {
+    final item = MenuItem.createWithLabelAndType(spec.label, spec.type);
+    if (item == null) return null;
+    final applied = _AppliedItem(item.id, spec._remembered);
+    applied._write(item, spec, null);
+    return (applied, item);
+  }
+
+  final MenuItemId itemId;
+
+  /// The last spec applied, as [MenuItemSpec._remembered].
+  MenuItemSpec spec;
+
+  /// The item's icon handle as last applied, standing in for the image.
+  int? _iconHandle;
+
+  /// The submenu [apply] attached to this item, if any.
+  MenuId? submenuId;
+
+  void update(Menu menu, MenuItemSpec next) {
+    if (_differs(next)) {
+      final item = menu.getItemById(itemId);
+      if (item != null) _write(item, next, spec);
+    }
+    spec = next._remembered;
+  }
+
+  /// Whether applying [next] needs the native item at all.
+  bool _differs(MenuItemSpec next) =>
+      next.submenu != null ||
+      submenuId != null ||
+      spec.label != next.label ||
+      spec.tooltip != next.tooltip ||
+      next.icon?.nativeHandle != _iconHandle ||
+      !_sameAccelerator(spec.accelerator, next.accelerator) ||
+      spec.isEnabled != next.isEnabled ||
+      spec.state != next.state ||
+      spec.radioGroup != next.radioGroup;
+
+  /// Writes every property of [next] that differs from [previous]; all of
+  /// them when there is no previous spec.
+  void _write(MenuItem item, MenuItemSpec next, MenuItemSpec? previous) {
+    if (next.type == MenuItemType.separator) return;
+
+    if (previous != null && previous.label != next.label) {
+      item.label = next.label;
+    }
+    if (previous?.tooltip != next.tooltip) item.tooltip = next.tooltip;
+    final iconHandle = next.icon?.nativeHandle;
+    if (previous == null ? iconHandle != null : iconHandle != _iconHandle) {
+      item.icon = next.icon;
+    }
+    _iconHandle = iconHandle;
+    if (!_sameAccelerator(previous?.accelerator, next.accelerator)) {
+      item.accelerator = next.accelerator;
+    }
+    if (previous == null
+        ? !next.isEnabled
+        : previous.isEnabled != next.isEnabled) {
+      item.isEnabled = next.isEnabled;
+    }
+    if (previous == null
+        ? next.state != MenuItemState.unchecked
+        : previous.state != next.state) {
+      item.state = next.state;
+    }
+    if (previous == null
+        ? next.radioGroup != null
+        : previous.radioGroup != next.radioGroup) {
+      item.radioGroup = next.radioGroup ?? _noRadioGroup;
+    }
+
+    final submenuItems = next.submenu;
+    if (submenuItems == null) {
+      if (submenuId != null) {
+        item.submenu = null;
+        MenuSpecs._forget([this]);
+        submenuId = null;
+      }
+      return;
+    }
+    var submenu = submenuId == null ? null : item.submenu;
+    if (submenu == null) {
+      submenu = Menu.create();
+      if (submenu == null) return;
+      item.submenu = submenu;
+      submenuId = submenu.id;
+    }
+    submenu.apply(submenuItems);
+  }
+
+  /// The group the C++ `MenuItem` starts out in, meaning none.
+  static const int _noRadioGroup = -1;
+
+  static bool _sameAccelerator(KeyboardAccelerator? a, KeyboardAccelerator? b) {
+    if (a == null || b == null) return a == b;
+    return a.modifiers == b.modifiers && a.key == b.key;
+  }
+}
@@ -0,0 +1,159 @@
+import 'dart:async';
+
+import '../preferences.dart';
+import '../support.dart';
+
+sealed class PreferencesEvent {
+  const PreferencesEvent({required this.scope});
+
+  /// The scope of the store that changed; null for the default store.
+  final String? scope;
+}
+
+final class PreferenceChangedEvent extends PreferencesEvent {
+  const PreferenceChangedEvent({
+    required super.scope,
+    required this.key,
+    required this.value,
+  });
+
+  final String key;
+  final String value;
+}
+
+final class PreferenceRemovedEvent extends PreferencesEvent {
+  const PreferenceRemovedEvent({required super.scope, required this.key});
+
+  final String key;
+}
+
+final class PreferencesClearedEvent extends PreferencesEvent {
+  const PreferencesClearedEvent({required super.scope});
+}
+
+/// Change notifications for one preferences scope within this isolate.
+///
+/// Hand-written rather than generated: `native_preferences_t` has no
+/// listeners, so only writes made through a notifier are seen. Route every
+/// write to a scope through [PreferencesNotifier.of] and each window can
+/// follow the others' changes without rescanning [Preferences.all]. Changes
+/// made by another process still need a native watch upstream.
+///
+/// Notifiers for the same scope share their listeners, but each one writes
+/// through the [Preferences] it was made from, and nothing here keeps that
+/// instance alive.
+///
+/// Events are coalesced per turn of the event loop. Each key reports only
+/// its last change, and a clear replaces everything queued before it.
+final class PreferencesNotifier {
+  PreferencesNotifier._(this.preferences, this._hub);
+
+  /// A notifier writing through [preferences], sharing listeners with every
+  /// other notifier for the same scope.
+  ///
+  /// ```dart
+  /// final settings = PreferencesNotifier.of(preferences);
+  /// settings.addListener((event) {
+  ///   if (event is PreferenceChangedEvent && event.key == 'theme') {
+  ///     applyTheme(event.value);
+  ///   }
+  /// });
+  /// settings.set('theme', 'dark');
+  /// ```
+  factory PreferencesNotifier.of(Preferences preferences) {
+    final scope = preferences.scope;
+    final hub = _hubs[scope] ??= _ScopeHub(scope);
+    return PreferencesNotifier._(preferences, hub);
+  }
+
+  /// Listeners and queued events per scope. No [Preferences] is kept here,
+  /// so a disposed instance is never written through by someone else.
+  static final Map<String?, _ScopeHub> _hubs = {};
+
+  /// The store writes go to.
+  final Preferences preferences;
+
+  final _ScopeHub _hub;
+
+  /// The scope of [preferences]; null for the default store.
+  String? get scope => _hub.scope;
+
+  bool set(String key, String value) {
+    if (!preferences.set(key, value)) return false;
+    _hub.queue(
+      key,
+      PreferenceChangedEvent(scope: scope, key: key, value: value),
+    );
+    return true;
+  }
+
+  bool remove(String key) {
+    if (!preferences.remove(key)) return false;
+    _hub.queue(key, PreferenceRemovedEvent(scope: scope, key: key));
+    return true;
+  }
+
+  bool clear() {
+    if (!preferences.clear()) return false;
+    _hub.queueClear();
+    return true;
+  }
+
+  /// Registers [callback] for every change made through a notifier for
+  /// this scope.
+  ListenerId addListener(void Function(PreferencesEvent) callback) =>
+      _hub.addListener(callback);
+
+  /// Unregisters a listener. Returns false if unknown.
+  bool removeListener(ListenerId listenerId) =>
+      _hub.listeners.remove(listenerId) != null;
+}
+
+/// What the notifiers of one scope share.
+final class _ScopeHub {
+  _ScopeHub(this.scope);
+
+  final String? scope;
+
+  final Map<ListenerId, void Function(PreferencesEvent)> listeners = {};
+  ListenerId _nextId = 1;
+
+  final Map<String, PreferencesEvent> _pending = {};
+  bool _cleared = false;
+  Timer? _timer;
+
+  ListenerId addListener(void Function(PreferencesEvent) callback) {
+    final id = _nextId++;
+    listeners[id] = callback;
+    return id;
+  }
+
+  void queue(String key, PreferencesEvent event) {
+    _pending.remove(key);
+    _pending[key] = event;
+    _timer ??= Timer(Duration.zero, _flush);
+  }
+
+  void queueClear() {
+    _pending.clear();
+    _cleared = true;
+    _timer ??= Timer(Duration.zero, _flush);
+  }
+
+  void _flush() {
+    _timer = null;
+    final events = [
+      if (_cleared) PreferencesClearedEvent(scope: scope),
+      ..._pending.values,
+    ];
+    _pending.clear();
+    _cleared = false;
+    // A callback may add or remove listeners; iterate over a snapshot.
+    final snapshot = listeners.values.toList();
+    for (final event in events) {
+      for (final listener in snapshot) {
+        listener(event);
+      }
+    }
+  }
+}
@@ -0,0 +1,61 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import '../preferences.dart';
+
+/// Typed values on top of [Preferences].
+///
+/// Hand-written rather than generated: `native_preferences_set`/`get` only
+/// store strings, so each value is kept in one fixed text form. Numbers use
+/// Dart's shortest round-tripping representation, booleans are `true` or
+/// `false`, and bytes are base64. Every getter returns null for a missing
+/// key and for a value that does not parse as the requested type, so a
+/// setting whose type changed between releases reads back as unset rather
+/// than throwing.
+///
+/// To load many settings at startup, read [Preferences.all] once and parse
+/// the map with [PreferenceValues]. That is one native call instead of one
+/// per key.
+extension TypedPreferences on Preferences {
+  int? getInt(String key) => PreferenceValues.parseInt(get(key, ''));
+
+  bool setInt(String key, int value) => set(key, value.toString());
+
+  double? getDouble(String key) => PreferenceValues.parseDouble(get(key, ''));
+
+  bool setDouble(String key, double value) => set(key, value.toString());
+
+  bool? getBool(String key) => PreferenceValues.parseBool(get(key, ''));
+
+  bool setBool(String key, bool value) => set(key, value.toString());
+
+  /// An empty list is stored as `''`, which is also what a missing key
+  /// reads as, so only this getter has to ask whether the key exists.
+  Uint8List? getBytes(String key) =>
+      contains(key) ? PreferenceValues.parseBytes(get(key, '')) : null;
+
+  bool setBytes(String key, List<int> value) => set(key, base64.encode(value));
+}
+
+/// Parsing the text forms written by [TypedPreferences].
+abstract final class PreferenceValues {
+  static int? parseInt(String? raw) => raw == null ? null : int.tryParse(raw);
+
+  static double? parseDouble(String? raw) =>
+      raw == null ? null : double.tryParse(raw);
+
+  static bool? parseBool(String? raw) => switch (raw) {
+    'true' => true,
+    'false' => false,
+    _ => null,
+  };
+
+  static Uint8List? parseBytes(String? raw) {
+    if (raw == null) return null;
+    try {
+      return base64.decode(raw);
+    } on FormatException {
+      return null;
+    }
+  }
+}
@@ -0,0 +1,105 @@
+import 'dart:async';
+
+import '../window.dart';
+
+/// How a [WindowEventCoalescer] treats bursts of move and resize events.
+sealed class WindowEventCoalescing {
+  const WindowEventCoalescing();
+
+  /// Every event is delivered; nothing is dropped.
+  const factory WindowEventCoalescing.all() = _All;
+
+  /// Per window, only the latest move and the latest resize seen during
+  /// one turn of the event loop are delivered.
+  const factory WindowEventCoalescing.latest() = _Throttle._latest;
+
+  /// Per window, at most one move and one resize are delivered per
+  /// [interval], each being the latest seen when the interval ends.
+  const factory WindowEventCoalescing.throttle(Duration interval) = _Throttle;
+}
+
+final class _All extends WindowEventCoalescing {
+  const _All();
+}
+
+final class _Throttle extends WindowEventCoalescing {
+  const _Throttle(this.interval);
+
+  const _Throttle._latest() : interval = Duration.zero;
+
+  final Duration interval;
+}
+
+/// Wraps a `WindowEvent` callback so dragging a window does not run it for
+/// every intermediate position.
+///
+/// Hand-written rather than generated: the native side emits one moved or
+/// resized event per platform configure event, and a listener that does
+/// real work for each of them (persisting layout, say) falls behind while
+/// the user drags. Other event types pass straight through, after any
+/// pending moves and resizes, so their relative order is kept.
+///
+/// ```dart
+/// final coalescer = WindowEventCoalescer(
+///   saveLayout,
+///   policy: const WindowEventCoalescing.throttle(Duration(milliseconds: 250)),
+/// );
+/// final listenerId = WindowManager.instance.addListener(coalescer.call);
+/// ```
+class WindowEventCoalescer {
+  WindowEventCoalescer(
+    this.callback, {
+    this.policy = const WindowEventCoalescing.latest(),
+  });
+
+  final void Function(WindowEvent) callback;
+  final WindowEventCoalescing policy;
+
+  // Keyed by window id and whether it is a resize; insertion order is
+  // delivery order.
+  final Map<(WindowId, bool), WindowEvent> _pending = {};
+  Timer? _timer;
+  int _dropped = 0;
+
+  /// How many move and resize events were superseded before delivery.
+  int get dropped => _dropped;
+
+  /// Hands [event] to [callback] now or once the current burst settles.
+  void call(WindowEvent event) {
+    final policy = this.policy;
+    if (policy is! _Throttle) {
+      callback(event);
+      return;
+    }
+
+    switch (event) {
+      case WindowMovedEvent(:final windowId) ||
+          WindowResizedEvent(:final windowId):
+        final key = (windowId, event is WindowResizedEvent);
+        if (_pending.remove(key) != null) _dropped++;
+        _pending[key] = event;
+        _timer ??= Timer(policy.interval, flush);
+        return;
+      default:
+        flush();
+        callback(event);
+    }
+  }
+
+  /// Delivers pending moves and resizes right away.
+  void flush() {
+    _timer?.cancel();
+    _timer = null;
+    if (_pending.isEmpty) return;
+    final events = _pending.values.toList();
+    _pending.clear();
+    events.forEach(callback);
+  }
+
+  /// Drops pending events without delivering them.
+  void dispose() {
+    _timer?.cancel();
+    _timer = null;
+    _pending.clear();
+  }
+}
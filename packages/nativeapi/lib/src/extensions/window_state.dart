@@ -0,0 +1,92 @@
+import 'dart:ui';
+
+import '../window.dart';
+
+/// What window chrome usually needs to know about a [Window], in one value.
+///
+/// Two states are equal when every field is, so a listener can compare the
+/// previous state with a fresh one and skip relayout when nothing changed.
+class WindowState {
+  const WindowState({
+    required this.windowId,
+    required this.bounds,
+    required this.contentBounds,
+    required this.isFocused,
+    required this.isVisible,
+    required this.isMaximized,
+    required this.isMinimized,
+    required this.isFullScreen,
+    required this.isAlwaysOnTop,
+    required this.opacity,
+  });
+
+  final WindowId windowId;
+  final Rect bounds;
+  final Rect contentBounds;
+  final bool isFocused;
+  final bool isVisible;
+  final bool isMaximized;
+  final bool isMinimized;
+  final bool isFullScreen;
+  final bool isAlwaysOnTop;
+  final double opacity;
+
+  @override
+  bool operator ==(Object other) =>
+      other is WindowState &&
+      other.windowId == windowId &&
+      other.bounds == bounds &&
+      other.contentBounds == contentBounds &&
+      other.isFocused == isFocused &&
+      other.isVisible == isVisible &&
+      other.isMaximized == isMaximized &&
+      other.isMinimized == isMinimized &&
+      other.isFullScreen == isFullScreen &&
+      other.isAlwaysOnTop == isAlwaysOnTop &&
+      other.opacity == opacity;
+
+  @override
+  int get hashCode => Object.hash(
+    windowId,
+    bounds,
+    contentBounds,
+    isFocused,
+    isVisible,
+    isMaximized,
+    isMinimized,
+    isFullScreen,
+    isAlwaysOnTop,
+    opacity,
+  );
+}
+
+/// Reading a [WindowState] off a [Window].
+///
+/// Hand-written rather than generated: the C API has no batched getter, so
+/// this makes ten regular native calls, one per field. That is no cheaper
+/// than reading the properties directly, and it is not a consistent
+/// snapshot either: the window can move or change state between two of
+/// the reads. What [state] buys is a single place to switch over once the
+/// native side grows a snapshot call.
+extension WindowStateSnapshot on Window {
+  /// The current state of this window.
+  ///
+  /// ```dart
+  /// final state = window.state;
+  /// if (state.isVisible && !state.isMinimized) {
+  ///   titleBar.layout(state.contentBounds, focused: state.isFocused);
+  /// }
+  /// ```
+  WindowState get state => WindowState(
+    windowId: id,
+    bounds: bounds,
+    contentBounds: contentBounds,
+    isFocused: isFocused,
+    isVisible: isVisible,
+    isMaximized: isMaximized,
+    isMinimized: isMinimized,
+    isFullScreen: isFullScreen,
+    isAlwaysOnTop: isAlwaysOnTop,
+    opacity: opacity,
+  );
+}
@@ -0,0 +1,151 @@
+import 'dart:ui';
+
+import '../window.dart';
+
+/// A batch of property changes for one [Window], applied by [commit].
+///
+/// Each property keeps only the last value queued for it. Geometry is
+/// tracked as an origin and a size, each for either the outer frame or the
+/// content area, and a later write only replaces the part it covers. When
+/// both parts are for the same frame they go out as a single `bounds` or
+/// `contentBounds` write instead of a move followed by a resize; otherwise
+/// the size is applied first and then the origin. Size constraints go out
+/// before any geometry so the new frame is not clamped by the old ones.
+class WindowUpdate {
+  WindowUpdate._(this.window);
+
+  /// The window this batch applies to.
+  final Window window;
+
+  Offset? _origin;
+  bool _originIsContent = false;
+  Size? _size;
+  bool _sizeIsContent = false;
+  Size? _minimumSize;
+  Size? _maximumSize;
+  String? _title;
+  TitleBarStyle? _titleBarStyle;
+  VisualEffect? _visualEffect;
+  Color? _backgroundColor;
+  double? _opacity;
+  bool? _hasShadow;
+  bool? _isAlwaysOnTop;
+  bool? _isResizable;
+  bool _committed = false;
+
+  set bounds(Rect value) {
+    _setOrigin(value.topLeft, content: false);
+    _setSize(value.size, content: false);
+  }
+
+  set position(Offset value) => _setOrigin(value, content: false);
+
+  set size(Size value) => _setSize(value, content: false);
+
+  set contentBounds(Rect value) {
+    _setOrigin(value.topLeft, content: true);
+    _setSize(value.size, content: true);
+  }
+
+  set contentSize(Size value) => _setSize(value, content: true);
+
+  set minimumSize(Size value) => _minimumSize = value;
+
+  set maximumSize(Size value) => _maximumSize = value;
+
+  set title(String value) => _title = value;
+
+  set titleBarStyle(TitleBarStyle value) => _titleBarStyle = value;
+
+  set visualEffect(VisualEffect value) => _visualEffect = value;
+
+  set backgroundColor(Color value) => _backgroundColor = value;
+
+  set opacity(double value) => _opacity = value;
+
+  set hasShadow(bool value) => _hasShadow = value;
+
+  set isAlwaysOnTop(bool value) => _isAlwaysOnTop = value;
+
+  set isResizable(bool value) => _isResizable = value;
+
+  /// Applies every queued change. A batch can only be committed once.
+  void commit() {
+    assert(!_committed, 'WindowUpdate committed twice');
+    _committed = true;
+
+    if (_minimumSize != null) window.minimumSize = _minimumSize!;
+    if (_maximumSize != null) window.maximumSize = _maximumSize!;
+    if (_isResizable != null) window.isResizable = _isResizable!;
+    if (_titleBarStyle != null) window.titleBarStyle = _titleBarStyle!;
+
+    _commitGeometry();
+
+    if (_title != null) window.title = _title!;
+    if (_visualEffect != null) window.visualEffect = _visualEffect!;
+    if (_backgroundColor != null) window.backgroundColor = _backgroundColor!;
+    if (_opacity != null) window.opacity = _opacity!;
+    if (_hasShadow != null) window.hasShadow = _hasShadow!;
+    if (_isAlwaysOnTop != null) window.isAlwaysOnTop = _isAlwaysOnTop!;
+  }
+
+  void _setOrigin(Offset value, {required bool content}) {
+    _origin = value;
+    _originIsContent = content;
+  }
+
+  void _setSize(Size value, {required bool content}) {
+    _size = value;
+    _sizeIsContent = content;
+  }
+
+  void _commitGeometry() {
+    final origin = _origin;
+    final size = _size;
+    if (origin != null && size != null && _originIsContent == _sizeIsContent) {
+      if (_originIsContent) {
+        window.contentBounds = origin & size;
+      } else {
+        window.bounds = origin & size;
+      }
+      return;
+    }
+
+    if (size != null) {
+      if (_sizeIsContent) {
+        window.contentSize = size;
+      } else {
+        window.setSize(size, false);
+      }
+    }
+    if (origin != null) {
+      if (_originIsContent) {
+        // There is no call that only moves the content area.
+        window.contentBounds = origin & window.contentSize;
+      } else {
+        window.position = origin;
+      }
+    }
+  }
+}
+
+/// Batching several property changes on a [Window].
+///
+/// Hand-written rather than generated: the C API has no transaction entry
+/// point, so [WindowUpdate.commit] still issues one call per changed
+/// property. What it saves is the redundant ones, above all the separate
+/// move and resize that make a restored layout visibly jump.
+extension WindowUpdates on Window {
+  /// Starts a batch of changes; nothing is applied until
+  /// [WindowUpdate.commit].
+  ///
+  /// ```dart
+  /// window.beginUpdate()
+  ///   ..minimumSize = const Size(400, 300)
+  ///   ..bounds = savedBounds
+  ///   ..titleBarStyle = TitleBarStyle.hidden
+  ///   ..opacity = 0.95
+  ///   ..commit();
+  /// ```
+  WindowUpdate beginUpdate() => WindowUpdate._(this);
+}
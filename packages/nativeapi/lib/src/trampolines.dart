@@ -0,0 +1,161 @@
+import 'dart:async';
+import 'dart:ffi' as ffi;
+
+import 'package:cnativeapi/cnativeapi.dart' as c;
+import 'package:meta/meta.dart';
+
+import 'support.dart';
+
+// Runtime support for the listener and callback code the bindgen Dart
+// templates emit. The templates live upstream and the wrappers in this tree
+// were generated before they targeted this file, so nothing calls into it
+// until they are regenerated. Kept out of support.dart, which the public
+// library re-exports, so none of it becomes package API.
+
+final _bindings = c.cnativeApiBindings;
+
+/// Trampolines handed to the C side, keyed by the registration they back.
+///
+/// Each one stays reachable for as long as the C side may call it and is
+/// closed once that registration is gone, so its native code is freed
+/// instead of piling up for the life of the process.
+@internal
+final class Trampolines<K> {
+  final Map<K, ffi.NativeCallable<Function>> _live = {};
+
+  /// Keeps [callable] alive for [key], closing any it replaces.
+  void keep(K key, ffi.NativeCallable<Function> callable) {
+    _close(_live[key]);
+    _live[key] = callable;
+  }
+
+  /// Closes the trampoline kept for [key], if any.
+  void release(K key) => _close(_live.remove(key));
+
+  static void _close(ffi.NativeCallable<Function>? callable) {
+    // The release may come from inside that very trampoline, e.g. a
+    // listener removing itself; close it only once the call has returned.
+    if (callable != null) scheduleMicrotask(callable.close);
+  }
+}
+
+/// Identifies one listener registration: the emitter it is on, then the
+/// listener id the C side returned.
+///
+/// The emitter is its native id where it has one (`Menu.id`, `MenuItem.id`,
+/// `TrayIcon.getId()`), since the C API hands out new wrappers, and so new
+/// handles, for the same object. A `KeyboardMonitor` has no id and is never
+/// handed out again, so it uses its handle. The singleton managers use 0.
+@internal
+typedef ListenerKey = (int emitter, ListenerId listener);
+
+/// Dart callbacks for one kind of event source, all reached through a
+/// single shared trampoline.
+///
+/// Each registration reserves a slot whose number travels to the C side as
+/// the listener's user data; the trampoline hands it back here to find the
+/// callback. Adding a listener is then a table insert rather than a fresh
+/// trampoline, and a source kind costs one trampoline per isolate no matter
+/// how many listeners it has.
+@internal
+final class ListenerSlots<E> {
+  final Map<int, void Function(E)> _callbacks = {};
+  final Map<ListenerKey, int> _slots = {};
+  int _lastSlot = 0;
+
+  /// Reserves a slot for [callback] and returns it as user data.
+  ffi.Pointer<ffi.Void> reserve(void Function(E) callback) {
+    final slot = ++_lastSlot;
+    _callbacks[slot] = callback;
+    return ffi.Pointer<ffi.Void>.fromAddress(slot);
+  }
+
+  /// Ties the slot in [userData] to the registration [key], so releasing
+  /// [key] frees it.
+  void bind(ListenerKey key, ffi.Pointer<ffi.Void> userData) {
+    final replaced = _slots[key];
+    if (replaced != null) _callbacks.remove(replaced);
+    _slots[key] = userData.address;
+  }
+
+  /// The callback reserved under [userData], or null once released.
+  void Function(E)? operator [](ffi.Pointer<ffi.Void> userData) =>
+      _callbacks[userData.address];
+
+  /// Frees the slot bound to [key], if any.
+  void release(ListenerKey key) {
+    final slot = _slots.remove(key);
+    if (slot != null) _callbacks.remove(slot);
+  }
+
+  /// Whether no slot is reserved or bound any more.
+  @visibleForTesting
+  bool get isEmpty => _callbacks.isEmpty && _slots.isEmpty;
+}
+
+/// Shortcut callback trampolines, held until nothing can fire them.
+///
+/// A callback fires from the manager while its shortcut is registered, and
+/// from `invoke` on any live handle to the shortcut. So trampolines are
+/// tracked per shortcut id together with a count of owned handles to it.
+/// They are closed only once that count is zero and the manager no longer
+/// has the id registered. Callers pick ids too, so two shortcuts can share
+/// one. Sharing only ever delays a close, never hastens it.
+@internal
+final class ShortcutCallbacks {
+  /// The check passed in tells whether the manager still has a shortcut
+  /// registered under an id.
+  @visibleForTesting
+  ShortcutCallbacks(this._isRegistered);
+
+  static final ShortcutCallbacks instance = ShortcutCallbacks(
+    _isRegisteredNatively,
+  );
+
+  final bool Function(int id) _isRegistered;
+  final Map<int, _ShortcutEntry> _entries = {};
+
+  /// Counts a newly adopted handle to the shortcut [id].
+  void addHandle(int id) => _entry(id).handles++;
+
+  /// Uncounts a freed handle to the shortcut [id].
+  void removeHandle(int id) {
+    final entry = _entries[id];
+    if (entry == null) return;
+    entry.handles--;
+    sweep(id);
+  }
+
+  /// Keeps [callable], now installed on the shortcut [id].
+  void keep(int id, ffi.NativeCallable<Function> callable) =>
+      _entry(id).callables.add(callable);
+
+  /// Closes the trampolines of [id] if nothing can fire them any more.
+  void sweep(int id) {
+    final entry = _entries[id];
+    if (entry == null || entry.handles > 0 || _isRegistered(id)) return;
+    _entries.remove(id);
+    entry.callables.forEach(Trampolines._close);
+  }
+
+  /// [sweep]s every shortcut id, e.g. after unregistering all of them.
+  void sweepAll() => _entries.keys.toList().forEach(sweep);
+
+  /// Whether trampolines are still kept for the shortcut [id].
+  @visibleForTesting
+  bool holds(int id) => _entries.containsKey(id);
+
+  _ShortcutEntry _entry(int id) => _entries.putIfAbsent(id, _ShortcutEntry.new);
+
+  static bool _isRegisteredNatively(int id) {
+    final registered = _bindings.native_shortcut_manager_get_with_id(id);
+    if (registered == 0) return false;
+    _bindings.native_shortcut_free(registered);
+    return true;
+  }
+}
+
+class _ShortcutEntry {
+  int handles = 0;
+  final List<ffi.NativeCallable<Function>> callables = [];
+}
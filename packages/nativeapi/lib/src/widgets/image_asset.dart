@@ -2,6 +2,7 @@ import 'dart:io';
 
 import 'package:path/path.dart' as path;
 
+import '../extensions/image_cache.dart';
 import '../image.dart';
 
 /// Loading an [Image] from a Flutter asset.
@@ -25,19 +26,28 @@ extension ImageAsset on Image {
   ///   assets:
   ///     - assets/icons/
   /// ```
-  static Image? fromAsset(String name) {
-    final executablePath = Platform.resolvedExecutable;
+  static Image? fromAsset(String name) => Image.fromFile(assetPath(name));
 
-    // Where most platforms put the bundle.
-    var assetPath = path.joinAll([
-      path.dirname(executablePath),
-      'data/flutter_assets',
-      name,
-    ]);
+  /// Like [fromAsset], but through [NativeImageCache.instance], so asking
+  /// for the same asset again returns the already decoded image.
+  ///
+  /// The image is shared with every other caller; leave disposing it to the
+  /// cache.
+  static Image? cachedFromAsset(String name) =>
+      NativeImageCache.instance.fromFile(assetPath(name));
+
+  /// Like [cachedFromAsset], but the file is looked up on disk
+  /// asynchronously; see [NativeImageCache.fromFileAsync].
+  static Future<Image?> cachedFromAssetAsync(String name) =>
+      NativeImageCache.instance.fromFileAsync(assetPath(name));
 
-    // macOS keeps them inside the app bundle's framework resources instead.
+  /// Where the bundled asset [name] lives on disk.
+  static String assetPath(String name) {
+    final executablePath = Platform.resolvedExecutable;
+
+    // macOS keeps them inside the app bundle's framework resources.
     if (Platform.isMacOS) {
-      assetPath = path.join(
+      return path.join(
         path.dirname(path.dirname(executablePath)),
         'Frameworks',
         'App.framework',
@@ -47,6 +57,11 @@ extension ImageAsset on Image {
       );
     }
 
-    return Image.fromFile(assetPath);
+    // Where most platforms put the bundle.
+    return path.joinAll([
+      path.dirname(executablePath),
+      'data/flutter_assets',
+      name,
+    ]);
   }
 }
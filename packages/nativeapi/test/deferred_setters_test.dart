@@ -0,0 +1,64 @@
+import 'package:fake_async/fake_async.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:nativeapi/nativeapi.dart';
+
+void main() {
+  group('DeferredWrites', () {
+    final writes = DeferredWrites.instance;
+
+    tearDown(writes.flush);
+
+    test('applies only the last write to a property', () {
+      fakeAsync((async) {
+        final applied = <String>[];
+        writes.queue(Window, 1, 'title', () => applied.add('a'));
+        writes.queue(Window, 1, 'title', () => applied.add('b'));
+        writes.queue(Window, 1, 'title', () => applied.add('c'));
+        expect(writes.length, 1);
+        expect(applied, isEmpty);
+
+        async.elapse(Duration.zero);
+        expect(applied, ['c']);
+        expect(writes.length, 0);
+      });
+    });
+
+    test("applies properties in the order of each one's last write", () {
+      fakeAsync((async) {
+        final applied = <String>[];
+        writes.queue(Window, 1, 'title', () => applied.add('title 1'));
+        writes.queue(Window, 1, 'opacity', () => applied.add('opacity'));
+        writes.queue(Window, 1, 'title', () => applied.add('title 2'));
+
+        async.elapse(Duration.zero);
+        expect(applied, ['opacity', 'title 2']);
+      });
+    });
+
+    test('keeps the same property of different objects apart', () {
+      fakeAsync((async) {
+        final applied = <String>[];
+        writes.queue(Window, 1, 'title', () => applied.add('window 1'));
+        writes.queue(Window, 2, 'title', () => applied.add('window 2'));
+        writes.queue(TrayIcon, 1, 'title', () => applied.add('tray 1'));
+
+        async.elapse(Duration.zero);
+        expect(applied, ['window 1', 'window 2', 'tray 1']);
+      });
+    });
+
+    test('flush applies pending writes at once and only once', () {
+      fakeAsync((async) {
+        final applied = <String>[];
+        writes.queue(MenuItem, 1, 'label', () => applied.add('label'));
+
+        writes.flush();
+        expect(applied, ['label']);
+
+        async.elapse(Duration.zero);
+        expect(applied, ['label']);
+      });
+    });
+  });
+}
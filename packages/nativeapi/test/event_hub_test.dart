@@ -0,0 +1,117 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:nativeapi/nativeapi.dart';
+
+/// Stands in for a native emitter's addListener/removeListener.
+class FakeEmitter {
+  final Map<ListenerId, void Function(Object)> listeners = {};
+  ListenerId _nextId = 1;
+
+  ListenerId addListener(void Function(Object) callback) {
+    final id = _nextId++;
+    listeners[id] = callback;
+    return id;
+  }
+
+  bool removeListener(ListenerId id) => listeners.remove(id) != null;
+
+  void emit(Object event) {
+    for (final listener in listeners.values.toList()) {
+      listener(event);
+    }
+  }
+}
+
+void main() {
+  group('EventHub', () {
+    late FakeEmitter emitter;
+    late EventHub<Object> hub;
+
+    setUp(() {
+      emitter = FakeEmitter();
+      hub = EventHub<Object>(emitter.addListener, emitter.removeListener);
+    });
+
+    test('only calls listeners whose type matches', () {
+      final ints = <int>[];
+      final strings = <String>[];
+      hub.on<int>(ints.add);
+      hub.on<String>(strings.add);
+
+      emitter.emit(1);
+      emitter.emit('a');
+      emitter.emit(2.5);
+
+      expect(ints, [1]);
+      expect(strings, ['a']);
+    });
+
+    test('holds a single native listener for all of its listeners', () {
+      hub.on<int>((_) {});
+      hub.on<String>((_) {});
+      hub.on<Object>((_) {});
+
+      expect(emitter.listeners, hasLength(1));
+    });
+
+    test('removes the native listener with the last off', () {
+      final first = hub.on<int>((_) {});
+      final second = hub.on<int>((_) {});
+
+      expect(hub.off(first), isTrue);
+      expect(emitter.listeners, hasLength(1));
+      expect(hub.hasListeners, isTrue);
+
+      expect(hub.off(second), isTrue);
+      expect(emitter.listeners, isEmpty);
+      expect(hub.hasListeners, isFalse);
+
+      expect(hub.off(second), isFalse);
+    });
+
+    test('registers again after going idle', () {
+      final received = <int>[];
+      hub.off(hub.on<int>((_) {}));
+      hub.on<int>(received.add);
+
+      emitter.emit(3);
+
+      expect(emitter.listeners, hasLength(1));
+      expect(received, [3]);
+    });
+
+    test('reports its first listener and losing its last', () {
+      var listens = 0;
+      var cancels = 0;
+      final hub = EventHub<Object>(
+        emitter.addListener,
+        emitter.removeListener,
+        onListen: () => listens++,
+        onCancel: () => cancels++,
+      );
+
+      final first = hub.on<int>((_) {});
+      final second = hub.on<int>((_) {});
+      hub.off(first);
+      expect((listens, cancels), (1, 0));
+
+      hub.off(second);
+      expect((listens, cancels), (1, 1));
+    });
+
+    test('lets a listener remove itself while events are dispatched', () {
+      final received = <int>[];
+      late ListenerId id;
+      id = hub.on<int>((event) {
+        received.add(event);
+        hub.off(id);
+      });
+      hub.on<int>(received.add);
+
+      emitter.emit(1);
+      emitter.emit(2);
+
+      expect(received, [1, 1, 2]);
+    });
+  });
+}
@@ -0,0 +1,116 @@
+import 'dart:ffi' as ffi;
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:nativeapi/src/trampolines.dart';
+
+void main() {
+  group('ListenerSlots', () {
+    test('leaves nothing behind after 100k add/remove cycles', () {
+      final slots = ListenerSlots<int>();
+      for (var listenerId = 1; listenerId <= 100000; listenerId++) {
+        final userData = slots.reserve((_) {});
+        slots.bind((7, listenerId), userData);
+        slots.release((7, listenerId));
+      }
+      expect(slots.isEmpty, isTrue);
+    });
+
+    test('finds a callback until its registration is released', () {
+      final slots = ListenerSlots<int>();
+      final received = <int>[];
+      final userData = slots.reserve(received.add);
+      slots.bind((1, 42), userData);
+
+      slots[userData]?.call(5);
+      slots.release((1, 42));
+      slots[userData]?.call(6);
+
+      expect(received, [5]);
+    });
+
+    test('keeps registrations on different emitters apart', () {
+      final slots = ListenerSlots<int>();
+      final first = slots.reserve((_) {});
+      final second = slots.reserve((_) {});
+      slots.bind((1, 1), first);
+      slots.bind((2, 1), second);
+
+      slots.release((1, 1));
+
+      expect(slots[first], isNull);
+      expect(slots[second], isNotNull);
+    });
+
+    test('frees the old slot when a registration is bound again', () {
+      final slots = ListenerSlots<int>();
+      final first = slots.reserve((_) {});
+      slots.bind((1, 1), first);
+      final second = slots.reserve((_) {});
+      slots.bind((1, 1), second);
+
+      expect(slots[first], isNull);
+      slots.release((1, 1));
+      expect(slots.isEmpty, isTrue);
+    });
+  });
+
+  group('ShortcutCallbacks', () {
+    late Set<int> registered;
+    late ShortcutCallbacks callbacks;
+
+    setUp(() {
+      registered = {};
+      callbacks = ShortcutCallbacks(registered.contains);
+    });
+
+    ffi.NativeCallable<ffi.Void Function()> trampoline() =>
+        ffi.NativeCallable<ffi.Void Function()>.isolateLocal(() {});
+
+    test('holds callbacks while an owned handle remains', () {
+      callbacks.addHandle(1);
+      callbacks.addHandle(1);
+      callbacks.keep(1, trampoline());
+
+      callbacks.removeHandle(1);
+      expect(callbacks.holds(1), isTrue);
+
+      callbacks.removeHandle(1);
+      expect(callbacks.holds(1), isFalse);
+    });
+
+    test('holds callbacks while the manager has the id registered', () {
+      callbacks.addHandle(1);
+      callbacks.keep(1, trampoline());
+      registered.add(1);
+
+      callbacks.removeHandle(1);
+      expect(callbacks.holds(1), isTrue);
+
+      registered.remove(1);
+      callbacks.sweep(1);
+      expect(callbacks.holds(1), isFalse);
+    });
+
+    test('sweeping an id that still has handles keeps it', () {
+      callbacks.addHandle(2);
+      callbacks.keep(2, trampoline());
+
+      callbacks.sweepAll();
+      expect(callbacks.holds(2), isTrue);
+    });
+
+    test('shortcuts sharing an id are counted together', () {
+      callbacks.addHandle(3);
+      callbacks.keep(3, trampoline());
+      callbacks.addHandle(3);
+      callbacks.keep(3, trampoline());
+
+      callbacks.removeHandle(3);
+      expect(callbacks.holds(3), isTrue);
+
+      callbacks.removeHandle(3);
+      expect(callbacks.holds(3), isFalse);
+    });
+  });
+}
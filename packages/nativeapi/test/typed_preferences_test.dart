@@ -0,0 +1,43 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:nativeapi/nativeapi.dart';
+
+void main() {
+  group('PreferenceValues', () {
+    test('round-trips values in the form TypedPreferences writes', () {
+      expect(PreferenceValues.parseInt((-42).toString()), -42);
+      expect(PreferenceValues.parseDouble(0.1.toString()), 0.1);
+      expect(PreferenceValues.parseBool(true.toString()), isTrue);
+      expect(PreferenceValues.parseBool(false.toString()), isFalse);
+      expect(
+        PreferenceValues.parseBytes(base64.encode([0, 1, 255])),
+        [0, 1, 255],
+      );
+    });
+
+    test('reads empty bytes back as empty, not null', () {
+      final bytes = PreferenceValues.parseBytes(base64.encode(<int>[]));
+      expect(bytes, isA<Uint8List>());
+      expect(bytes, isEmpty);
+    });
+
+    test('reads a value of another type as null', () {
+      expect(PreferenceValues.parseInt('1.5'), isNull);
+      expect(PreferenceValues.parseInt('true'), isNull);
+      expect(PreferenceValues.parseDouble('yes'), isNull);
+      expect(PreferenceValues.parseBool('1'), isNull);
+      expect(PreferenceValues.parseBool('True'), isNull);
+      expect(PreferenceValues.parseBytes('not base64!'), isNull);
+    });
+
+    test('reads a missing value as null', () {
+      expect(PreferenceValues.parseInt(null), isNull);
+      expect(PreferenceValues.parseDouble(null), isNull);
+      expect(PreferenceValues.parseBool(null), isNull);
+      expect(PreferenceValues.parseBytes(null), isNull);
+    });
+  });
+}
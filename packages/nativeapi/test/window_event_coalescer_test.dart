@@ -0,0 +1,117 @@
+import 'dart:ui';
+
+import 'package:fake_async/fake_async.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:nativeapi/nativeapi.dart';
+
+WindowMovedEvent moved(WindowId windowId, double x) =>
+    WindowMovedEvent(windowId: windowId, newPosition: Offset(x, 0));
+
+WindowResizedEvent resized(WindowId windowId, double width) =>
+    WindowResizedEvent(windowId: windowId, newSize: Size(width, 100));
+
+void main() {
+  group('WindowEventCoalescer', () {
+    test('delivers only the latest move per window each turn', () {
+      fakeAsync((async) {
+        final delivered = <WindowEvent>[];
+        final coalescer = WindowEventCoalescer(delivered.add);
+
+        coalescer(moved(1, 10));
+        coalescer(moved(1, 20));
+        coalescer(moved(1, 30));
+        expect(delivered, isEmpty);
+
+        async.elapse(Duration.zero);
+        expect(delivered, hasLength(1));
+        expect((delivered.single as WindowMovedEvent).newPosition.dx, 30);
+        expect(coalescer.dropped, 2);
+      });
+    });
+
+    test('keeps moves and resizes of each window apart', () {
+      fakeAsync((async) {
+        final delivered = <WindowEvent>[];
+        final coalescer = WindowEventCoalescer(delivered.add);
+
+        coalescer(moved(1, 10));
+        coalescer(resized(1, 200));
+        coalescer(moved(2, 10));
+        coalescer(resized(1, 300));
+
+        async.elapse(Duration.zero);
+        expect(delivered, hasLength(3));
+        expect(coalescer.dropped, 1);
+      });
+    });
+
+    test('flushes pending moves before any other event', () {
+      fakeAsync((async) {
+        final delivered = <WindowEvent>[];
+        final coalescer = WindowEventCoalescer(delivered.add);
+
+        coalescer(moved(1, 10));
+        coalescer(moved(1, 20));
+        coalescer(const WindowFocusedEvent(windowId: 1));
+
+        expect(delivered, hasLength(2));
+        expect((delivered[0] as WindowMovedEvent).newPosition.dx, 20);
+        expect(delivered[1], isA<WindowFocusedEvent>());
+        expect(coalescer.dropped, 1);
+
+        // Nothing is left for the timer to deliver twice.
+        async.elapse(Duration.zero);
+        expect(delivered, hasLength(2));
+      });
+    });
+
+    test('throttles to one delivery per interval', () {
+      fakeAsync((async) {
+        final delivered = <WindowEvent>[];
+        final coalescer = WindowEventCoalescer(
+          delivered.add,
+          policy: const WindowEventCoalescing.throttle(
+            Duration(milliseconds: 100),
+          ),
+        );
+
+        coalescer(moved(1, 10));
+        async.elapse(const Duration(milliseconds: 50));
+        coalescer(moved(1, 20));
+        expect(delivered, isEmpty);
+
+        async.elapse(const Duration(milliseconds: 50));
+        expect(delivered, hasLength(1));
+        expect((delivered.single as WindowMovedEvent).newPosition.dx, 20);
+      });
+    });
+
+    test('passes everything through with the all policy', () {
+      final delivered = <WindowEvent>[];
+      final coalescer = WindowEventCoalescer(
+        delivered.add,
+        policy: const WindowEventCoalescing.all(),
+      );
+
+      coalescer(moved(1, 10));
+      coalescer(moved(1, 20));
+
+      expect(delivered, hasLength(2));
+      expect(coalescer.dropped, 0);
+    });
+
+    test('dispose drops pending events', () {
+      fakeAsync((async) {
+        final delivered = <WindowEvent>[];
+        final coalescer = WindowEventCoalescer(delivered.add);
+
+        coalescer(moved(1, 10));
+        coalescer.dispose();
+
+        async.elapse(Duration.zero);
+        expect(delivered, isEmpty);
+      });
+    });
+  });
+}